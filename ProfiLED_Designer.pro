@@ -26,11 +26,13 @@ DEFINES += QT_DEPRECATED_WARNINGS
 SOURCES += \
         main.cpp \
         profiled_designer.cpp \
-    design_scene.cpp
+    design_scene.cpp \
+    ledbin_reader.cpp
 
 HEADERS += \
         profiled_designer.h \
-    design_scene.h
+    design_scene.h \
+    ledbin_reader.h
 
 FORMS += \
         profiled_designer.ui
@@ -33,6 +33,13 @@ void design_scene::save_patterns_to_file(QString& file_name)
     strip->save_to_file(file_name);
 }
 
+qint16 design_scene::play_bin(const ledbin_reader* bin)
+{
+    //binary has no positions, LEDs the design lacks are not shown
+    strip->set_bin_source(bin);
+    return qMax(0, bin->led_count() - strip->get_num_leds());
+}
+
 //Use this event to initiate LED movement
 void design_scene::mouseDoubleClickEvent(QGraphicsSceneMouseEvent * mouseEvent)
 {
@@ -81,7 +88,9 @@ QPointF design_scene::get_snap_coords(QPointF pt)
 }
 
 led_strip::led_strip(design_scene *s) :
-    scene(s)
+    cnt(0),
+    scene(s),
+    bin_source(nullptr)
 {
     num_leds = 0;
 }
@@ -216,23 +225,103 @@ void led_strip::save_to_file(QString& file_name)
     delete[] prev_color_list;
 }
 
-void led_strip::loop_player()
+void led_strip::set_bin_source(const ledbin_reader* bin)
 {
-    QColor curr_color;
-    QList<QGraphicsItem*> child_list;
+    if(bin == bin_source) {
+        return;     //nothing attached or detached, keep the current position
+    }
+    bin_source = bin;
+    cnt = 0;
+    //binaries start from black, clear whatever the last preview left behind
     for(qint8 i = 0; i < strip.length(); i++) {
-        curr_color = get_color_at_time(i, cnt);
-        if(strip[i].led->brush().color() != curr_color) {
-            qDebug() << cnt << i << curr_color.name();
-            strip[i].led->setBrush(QBrush(curr_color));
-            child_list = strip[i].led->childItems();
-            strip[i].id->setBrush(QColor(255 - curr_color.red(),
-                                           255 - curr_color.green(),
-                                           255 - curr_color.blue()));
+        set_preview_color(i, Qt::black);
+    }
+}
+
+void led_strip::set_preview_color(qint8 led_id, QColor color)
+{
+    if(strip[led_id].led->brush().color() != color) {
+        qDebug() << cnt << led_id << color.name();
+        strip[led_id].led->setBrush(QBrush(color));
+        strip[led_id].id->setBrush(QColor(255 - color.red(),
+                                          255 - color.green(),
+                                          255 - color.blue()));
+    }
+}
+
+void led_strip::loop_player()
+{
+    if(bin_source != nullptr) {
+        //only apply the changes recorded for this tick
+        quint32 first, last;
+        bin_source->records_at_tick(cnt, first, last);
+        for(quint32 i = first; i < last; i++) {
+            ledbin_reader::record rec = bin_source->record_at(i);
+            if(rec.led_id < strip.length()) {
+                set_preview_color(rec.led_id, rec.color);
+            }
         }
+        cnt++;
+        if(cnt > bin_source->end_tick()) {
+            cnt = 0;    //restart loop
+        }
+        return;
+    }
+    for(qint8 i = 0; i < strip.length(); i++) {
+        set_preview_color(i, get_color_at_time(i, cnt));
     }
     cnt++;
     if(cnt > (global_loop_time*100 - 1)) {
         cnt = 0;    //restart loop
     }
 }
+
+//Render the design tick by tick the way save_to_file() does and check the
+//state the binary holds at every tick against it
+bool led_strip::verify_against_bin(const ledbin_reader& bin, ledbin_reader::mismatch& first)
+{
+    qint16 leds = strip.length();
+    if(bin.led_count() != leds) {
+        first.type = ledbin_reader::mismatch::led_count;
+        first.expected_count = leds;
+        first.actual_count = bin.led_count();
+        return false;
+    }
+    if(leds == 0) {
+        return true;    //nothing exported either
+    }
+    quint16 loop_end = global_loop_time*100 - 1;
+    if(bin.end_tick() != loop_end) {
+        first.type = ledbin_reader::mismatch::loop_length;
+        first.expected_count = loop_end;
+        first.actual_count = bin.end_tick();
+        return false;
+    }
+    QVector<QRgb> bin_state(leds, qRgb(0, 0, 0));
+    QRgb expected;
+    quint32 start, stop;
+    for(quint32 tick = 0; tick <= loop_end; tick++) {
+        bin.records_at_tick(tick, start, stop);
+        for(quint32 i = start; i < stop; i++) {
+            ledbin_reader::record rec = bin.record_at(i);
+            bin_state[rec.led_id] = rec.color.rgb();
+        }
+        for(qint16 led = 0; led < leds; led++) {
+            //everything is reset to black at the end of the loop
+            if(tick < loop_end) {
+                expected = get_color_at_time(led, tick).rgb();
+            } else {
+                expected = qRgb(0, 0, 0);
+            }
+            if(bin_state[led] != expected) {
+                first.type = ledbin_reader::mismatch::color;
+                first.tick = tick;
+                first.led_id = led;
+                first.expected = QColor(expected);
+                first.actual = QColor(bin_state[led]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -11,6 +11,7 @@
 #include <QList>
 #include <QColor>
 #include <QFile>
+#include "ledbin_reader.h"
 class design_scene;
 class pattern
 {
@@ -70,6 +71,11 @@ public:
     {
         return strip[led_id].pattern_list;
     }
+    //play back a .ledbin instead of the patterns, nullptr returns to the design;
+    //only a real attach/detach restarts the loop and clears the LEDs
+    void set_bin_source(const ledbin_reader* bin);
+    qint16 get_num_leds() { return num_leds; }
+    bool verify_against_bin(const ledbin_reader& bin, ledbin_reader::mismatch& first);
 public slots:
     void loop_player();
 private:
@@ -78,7 +84,9 @@ private:
     qint8 num_leds;
     design_scene *scene;
     QList<led_instance> strip;
+    const ledbin_reader* bin_source;
     QColor get_color_at_time(qint8 led_id,qint16 time);
+    void set_preview_color(qint8 led_id, QColor color);
 };
 
 class design_scene : public QGraphicsScene
@@ -95,6 +103,13 @@ public:
         return strip->get_led_pattern_list(led_id);
     }
     void save_patterns_to_file(QString& file_name);
+    //returns the number of LEDs in the binary the design has no place for
+    qint16 play_bin(const ledbin_reader* bin);
+    void stop_bin() { strip->set_bin_source(nullptr); }
+    bool verify_bin(const ledbin_reader& bin, ledbin_reader::mismatch& first)
+    {
+        return strip->verify_against_bin(bin, first);
+    }
 
 signals:
 
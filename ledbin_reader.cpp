@@ -0,0 +1,195 @@
+#include "ledbin_reader.h"
+#include <string.h>
+
+ledbin_reader::ledbin_reader() :
+    data(nullptr),
+    num_records(0),
+    num_leds(0),
+    last_tick(0)
+{
+}
+
+ledbin_reader::~ledbin_reader()
+{
+    close();
+}
+
+bool ledbin_reader::open(const QString& file_name)
+{
+    close();
+    file.setFileName(file_name);
+    if(!file.open(QIODevice::ReadOnly)) {
+        error = file.errorString();
+        return false;
+    }
+    if(file.size() % record_size != 0) {
+        error = QString("%1 bytes is not a whole number of %2 byte records")
+                .arg(file.size()).arg(record_size);
+        file.close();
+        return false;
+    }
+    num_records = file.size() / record_size;
+    if(num_records == 0) {
+        //nothing to map, a design without LEDs
+        return build_index();
+    }
+    data = file.map(0, file.size());
+    if(data == nullptr) {
+        error = file.errorString();
+        file.close();
+        return false;
+    }
+    if(!build_index()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void ledbin_reader::close()
+{
+    if(data != nullptr) {
+        file.unmap(const_cast<uchar*>(data));
+        data = nullptr;
+    }
+    if(file.isOpen()) {
+        file.close();
+    }
+    num_records = 0;
+    num_leds = 0;
+    last_tick = 0;
+    tick_index.clear();
+}
+
+bool ledbin_reader::build_index()
+{
+    //single pass over the mapping, records have to be sorted by tick
+    quint16 prev_tick = 0;
+    for(quint32 i = 0; i < num_records; i++) {
+        const uchar* rec = data + i*record_size;
+        quint16 tick = tick_of(i);
+        if(tick < prev_tick) {
+            error = QString("record %1 goes back in time (tick %2 after %3)")
+                    .arg(i).arg(tick).arg(prev_tick);
+            return false;
+        }
+        if(rec[2] > 127) {
+            error = QString("record %1 has invalid LED id %2").arg(i).arg(rec[2]);
+            return false;
+        }
+        if(rec[2] >= num_leds) {
+            num_leds = rec[2] + 1;
+        }
+        prev_tick = tick;
+    }
+    last_tick = prev_tick;
+
+    tick_index.resize(last_tick + 2);
+    quint32 rec_idx = 0;
+    for(quint32 tick = 0; tick <= quint32(last_tick) + 1; tick++) {
+        while(rec_idx < num_records && tick_of(rec_idx) < tick) {
+            rec_idx++;
+        }
+        tick_index[tick] = rec_idx;
+    }
+    return true;
+}
+
+ledbin_reader::record ledbin_reader::record_at(quint32 index) const
+{
+    const uchar* rec = data + index*record_size;
+    record ret;
+    ret.tick = tick_of(index);
+    ret.led_id = rec[2];
+    ret.color = QColor(rec[3], rec[4], rec[5]);
+    return ret;
+}
+
+void ledbin_reader::records_at_tick(quint16 tick, quint32& first, quint32& last) const
+{
+    if(tick > last_tick) {
+        first = last = num_records;
+        return;
+    }
+    first = tick_index[tick];
+    last = tick_index[tick + 1];
+}
+
+bool ledbin_reader::compare(const ledbin_reader& other, mismatch& first) const
+{
+    if(num_records == other.num_records &&
+       (num_records == 0 || memcmp(data, other.data, num_records*record_size) == 0)) {
+        return true;
+    }
+    if(num_leds != other.num_leds) {
+        first.type = mismatch::led_count;
+        first.expected_count = num_leds;
+        first.actual_count = other.num_leds;
+        return false;
+    }
+    if(last_tick != other.last_tick) {
+        first.type = mismatch::loop_length;
+        first.expected_count = last_tick;
+        first.actual_count = other.last_tick;
+        return false;
+    }
+    //files differ, walk both tick by tick to find the first visible difference
+    QVector<QRgb> expected(num_leds, qRgb(0, 0, 0));
+    QVector<QRgb> actual(num_leds, qRgb(0, 0, 0));
+    quint32 start, stop;
+    for(quint32 tick = 0; tick <= last_tick; tick++) {
+        records_at_tick(tick, start, stop);
+        for(quint32 i = start; i < stop; i++) {
+            const uchar* rec = data + i*record_size;
+            expected[rec[2]] = qRgb(rec[3], rec[4], rec[5]);
+        }
+        other.records_at_tick(tick, start, stop);
+        for(quint32 i = start; i < stop; i++) {
+            const uchar* rec = other.data + i*record_size;
+            actual[rec[2]] = qRgb(rec[3], rec[4], rec[5]);
+        }
+        for(qint16 led = 0; led < num_leds; led++) {
+            if(expected[led] != actual[led]) {
+                first.type = mismatch::color;
+                first.tick = tick;
+                first.led_id = led;
+                first.expected = QColor(expected[led]);
+                first.actual = QColor(actual[led]);
+                return false;
+            }
+        }
+    }
+    //same colors throughout but encoded differently, point at the first record
+    quint32 i = 0;
+    while(i < num_records && i < other.num_records &&
+          memcmp(data + i*record_size, other.data + i*record_size, record_size) == 0) {
+        i++;
+    }
+    const ledbin_reader* at = &other;
+    if(i < num_records && (i >= other.num_records || tick_of(i) <= other.tick_of(i))) {
+        at = this;
+    }
+    first.type = mismatch::record;
+    first.tick = at->tick_of(i);
+    first.led_id = at->data[i*record_size + 2];
+    return false;
+}
+
+QString ledbin_reader::mismatch::toString() const
+{
+    switch(type) {
+    case led_count:
+        return QString("LED count differs: expected %1, got %2")
+                .arg(expected_count).arg(actual_count);
+    case loop_length:
+        return QString("loop length differs: expected %1 ticks, got %2 ticks")
+                .arg(expected_count).arg(actual_count);
+    case color:
+        return QString("first mismatch at tick %1, LED %2: expected %3, got %4")
+                .arg(tick).arg(led_id).arg(expected.name(), actual.name());
+    case record:
+        return QString("records differ from tick %1 (LED %2) on, colors are identical")
+                .arg(tick).arg(led_id);
+    }
+    return QString();
+}
@@ -0,0 +1,81 @@
+#ifndef LEDBIN_READER_H
+#define LEDBIN_READER_H
+
+#include <QFile>
+#include <QColor>
+#include <QVector>
+#include <QString>
+
+//Read-only view of a .ledbin file as written by led_strip::save_to_file().
+//The file is a stream of 6 byte records: tick (16 bit, big endian), led id,
+//red, green, blue. Each record is a color change; an LED holds its color
+//until the next record for it and every LED starts out black. The last tick
+//carries the end-of-loop reset. A design without LEDs exports an empty file.
+//The file is memory mapped and never copied, the only index built is the
+//first record of every tick.
+class ledbin_reader
+{
+public:
+    static const int record_size = 6;
+
+    struct record {
+        quint16 tick;
+        quint8 led_id;
+        QColor color;
+    };
+
+    //first difference found by compare() or led_strip::verify_against_bin()
+    struct mismatch {
+        enum mismatch_type {
+            led_count,      //expected_count/actual_count hold the LED counts
+            loop_length,    //expected_count/actual_count hold the end ticks
+            color,          //led_id shows actual instead of expected at tick
+            record          //same colors, but records differ from tick on
+        } type;
+        quint16 tick;
+        quint8 led_id;
+        QColor expected;
+        QColor actual;
+        qint32 expected_count;
+        qint32 actual_count;
+        QString toString() const;
+    };
+
+    ledbin_reader();
+    ~ledbin_reader();
+    bool open(const QString& file_name);
+    void close();
+    bool is_open() const { return file.isOpen(); }
+    QString error_string() const { return error; }
+    QString file_name() const { return file.fileName(); }
+
+    quint32 record_count() const { return num_records; }
+    qint16 led_count() const { return num_leds; }
+    //tick of the end-of-loop reset, i.e. the number of rendered ticks
+    quint16 end_tick() const { return last_tick; }
+    record record_at(quint32 index) const;
+
+    //records in [first, last) all carry the given tick
+    void records_at_tick(quint16 tick, quint32& first, quint32& last) const;
+
+    //Compare against another binary, identical exporters give byte identical
+    //files. Returns false and fills the first difference otherwise.
+    bool compare(const ledbin_reader& other, mismatch& first) const;
+private:
+    QFile file;
+    const uchar* data;
+    quint32 num_records;
+    qint16 num_leds;
+    quint16 last_tick;
+    QString error;
+    //index of the first record of each tick, with one extra entry at the end
+    QVector<quint32> tick_index;
+    inline quint16 tick_of(quint32 index) const
+    {
+        const uchar* rec = data + index*record_size;
+        return quint16(rec[0] << 8 | rec[1]);
+    }
+    bool build_index();
+};
+
+#endif // LEDBIN_READER_H
@@ -0,0 +1,53 @@
+#include "ledbin_reader.h"
+#include <QCoreApplication>
+#include <QStringList>
+#include <QTextStream>
+
+//Usage:
+//  ledbin_tool info <file.ledbin>              summary of the binary
+//  ledbin_tool dump <file.ledbin>              one line per record
+//  ledbin_tool diff <expected> <actual>        compare two binaries tick by tick
+//Exits with 0 on success/match, 1 on mismatch and 2 on bad input.
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QStringList args = a.arguments();
+    QTextStream out(stdout);
+    QTextStream err(stderr);
+
+    if(args.length() < 3 || (args[1] == "diff" && args.length() < 4)) {
+        err << "usage: ledbin_tool info|dump <file.ledbin>\n"
+               "       ledbin_tool diff <expected.ledbin> <actual.ledbin>\n";
+        return 2;
+    }
+    ledbin_reader bin;
+    if(!bin.open(args[2])) {
+        err << args[2] << ": " << bin.error_string() << "\n";
+        return 2;
+    }
+    if(args[1] == "info") {
+        out << bin.file_name() << ": " << bin.record_count() << " records, "
+            << bin.led_count() << " LEDs, " << bin.end_tick() << " ticks\n";
+    } else if(args[1] == "dump") {
+        for(quint32 i = 0; i < bin.record_count(); i++) {
+            ledbin_reader::record rec = bin.record_at(i);
+            out << rec.tick << " " << rec.led_id << " " << rec.color.name() << "\n";
+        }
+    } else if(args[1] == "diff") {
+        ledbin_reader other;
+        if(!other.open(args[3])) {
+            err << args[3] << ": " << other.error_string() << "\n";
+            return 2;
+        }
+        ledbin_reader::mismatch first;
+        if(!bin.compare(other, first)) {
+            out << first.toString() << "\n";
+            return 1;
+        }
+        out << "identical, " << bin.end_tick() << " ticks\n";
+    } else {
+        err << "unknown command " << args[1] << "\n";
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,32 @@
+#-------------------------------------------------
+#
+# Command line inspector for exported .ledbin files
+#
+#-------------------------------------------------
+
+QT       += core gui
+QT       -= widgets
+
+TARGET = ledbin_tool
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+
+DEFINES += QT_DEPRECATED_WARNINGS
+
+INCLUDEPATH += ..
+
+SOURCES += \
+        ledbin_tool.cpp \
+    ../ledbin_reader.cpp
+
+HEADERS += \
+    ../ledbin_reader.h
+
+# "make check" runs the tool against the fixtures in tests/
+check.commands = sh $$PWD/tests/run_checks.sh $$OUT_PWD/$$TARGET $$PWD/tests
+check.depends = $(TARGET)
+QMAKE_EXTRA_TARGETS += check
+
+DISTFILES += \
+    tests/run_checks.sh
@@ -0,0 +1,50 @@
+#!/bin/sh
+# Regression checks for ledbin_tool against the fixtures in this directory.
+# usage: run_checks.sh <ledbin_tool binary> <fixture dir>
+#
+# base.ledbin        2 LEDs, LED 0 red->blue at tick 5, reset at tick 99
+# base_copy.ledbin   byte identical copy of base
+# color.ledbin       LED 0 turns white instead of blue at tick 5
+# redundant.ledbin   base plus a repeated blue record at tick 7
+# loop.ledbin        base with the reset moved to tick 199
+# extra_led.ledbin   base plus a third LED that only gets the black reset
+# empty.ledbin       what a design without LEDs exports
+# truncated.ledbin   base missing its last byte
+# backwards.ledbin   records out of tick order
+
+tool=$1
+dir=$2
+failed=0
+
+# expect <exit code> <output substring> <args...>
+expect() {
+    code=$1
+    text=$2
+    shift 2
+    out=$("$tool" "$@" 2>&1)
+    ret=$?
+    if [ "$ret" -ne "$code" ] || ! printf '%s' "$out" | grep -qF "$text"; then
+        echo "FAIL: ledbin_tool $* -> $ret: $out (expected $code: $text)"
+        failed=1
+    else
+        echo "ok: ledbin_tool $*"
+    fi
+}
+
+expect 0 "5 records, 2 LEDs, 99 ticks" info "$dir/base.ledbin"
+expect 0 "5 0 #0000ff" dump "$dir/base.ledbin"
+expect 0 "0 records, 0 LEDs, 0 ticks" info "$dir/empty.ledbin"
+expect 0 "identical, 99 ticks" diff "$dir/base.ledbin" "$dir/base_copy.ledbin"
+expect 0 "identical, 0 ticks" diff "$dir/empty.ledbin" "$dir/empty.ledbin"
+expect 1 "first mismatch at tick 5, LED 0: expected #0000ff, got #ffffff" \
+    diff "$dir/base.ledbin" "$dir/color.ledbin"
+expect 1 "records differ from tick 7 (LED 0) on" diff "$dir/base.ledbin" "$dir/redundant.ledbin"
+expect 1 "loop length differs: expected 99 ticks, got 199 ticks" \
+    diff "$dir/base.ledbin" "$dir/loop.ledbin"
+expect 1 "LED count differs: expected 2, got 3" diff "$dir/base.ledbin" "$dir/extra_led.ledbin"
+expect 1 "LED count differs: expected 2, got 0" diff "$dir/base.ledbin" "$dir/empty.ledbin"
+expect 2 "29 bytes is not a whole number of 6 byte records" info "$dir/truncated.ledbin"
+expect 2 "record 1 goes back in time (tick 0 after 5)" info "$dir/backwards.ledbin"
+expect 2 "usage" diff "$dir/base.ledbin"
+
+exit $failed
@@ -40,6 +40,7 @@ profiled_designer::profiled_designer(QWidget *parent) :
 
 void profiled_designer::play_button_handler(bool action)
 {
+    scene->stop_bin();
     scene->set_loop_time(ui->loop_duration->value());
     timer->start(10);
 }
@@ -192,6 +193,54 @@ void profiled_designer::save()
 {
 }
 
+void profiled_designer::playBin()
+{
+    QString fileName = QFileDialog::getOpenFileName(this,
+        tr("Play LED Designer Binary"), QString(), tr("LED Designer Binary Files (*.ledbin)"));
+    if(fileName.isEmpty()) {
+        return;
+    }
+    timer->stop();
+    scene->stop_bin();
+    if(!preview_bin.open(fileName)) {
+        QMessageBox::warning(this, tr("Play LED Designer Binary"),
+                             tr("Cannot read %1:\n%2").arg(fileName, preview_bin.error_string()));
+        return;
+    }
+    qint16 skipped = scene->play_bin(&preview_bin);
+    if(skipped > 0) {
+        statusBar()->showMessage(tr("%1 LEDs of the binary are not in the design and are not shown")
+                                 .arg(skipped));
+    }
+    timer->start(10);
+}
+
+void profiled_designer::verifyBin()
+{
+    QString fileName = QFileDialog::getOpenFileName(this,
+        tr("Verify LED Designer Binary"), QString(), tr("LED Designer Binary Files (*.ledbin)"));
+    if(fileName.isEmpty()) {
+        return;
+    }
+    ledbin_reader bin;
+    if(!bin.open(fileName)) {
+        QMessageBox::warning(this, tr("Verify LED Designer Binary"),
+                             tr("Cannot read %1:\n%2").arg(fileName, bin.error_string()));
+        return;
+    }
+    ledbin_reader::mismatch first;
+    scene->set_loop_time(ui->loop_duration->value());
+    if(scene->verify_bin(bin, first)) {
+        QMessageBox::information(this, tr("Verify LED Designer Binary"),
+                                 tr("%1 matches the design (%2 records, %3 ticks).")
+                                 .arg(fileName).arg(bin.record_count()).arg(bin.end_tick()));
+    } else {
+        //expected is the design, actual the binary
+        QMessageBox::warning(this, tr("Verify LED Designer Binary"),
+                             tr("%1 does not match the design:\n%2").arg(fileName, first.toString()));
+    }
+}
+
 void profiled_designer::createActions()
 {
     newAct = new QAction(tr("&New"), this);
@@ -208,6 +257,14 @@ void profiled_designer::createActions()
     saveAct->setShortcuts(QKeySequence::Save);
     saveAct->setStatusTip(tr("Save the document to disk"));
     connect(saveAct, &QAction::triggered, this, &profiled_designer::save);
+
+    playBinAct = new QAction(tr("&Play Binary..."), this);
+    playBinAct->setStatusTip(tr("Preview an exported .ledbin file"));
+    connect(playBinAct, &QAction::triggered, this, &profiled_designer::playBin);
+
+    verifyBinAct = new QAction(tr("&Verify Binary..."), this);
+    verifyBinAct->setStatusTip(tr("Compare an exported .ledbin file against the design"));
+    connect(verifyBinAct, &QAction::triggered, this, &profiled_designer::verifyBin);
 }
 
 void profiled_designer::createMenus()
@@ -216,6 +273,9 @@ void profiled_designer::createMenus()
     fileMenu->addAction(newAct);
     fileMenu->addAction(openAct);
     fileMenu->addAction(saveAct);
+    fileMenu->addSeparator();
+    fileMenu->addAction(playBinAct);
+    fileMenu->addAction(verifyBinAct);
 }
 
 profiled_designer::~profiled_designer()
@@ -35,6 +35,9 @@ private:
     QAction *newAct;
     QAction *openAct;
     QAction *saveAct;
+    QAction *playBinAct;
+    QAction *verifyBinAct;
+    ledbin_reader preview_bin;
     qint8 selected_led_id;
     pattern curr_pattern;
     QTimer *timer;
@@ -59,6 +62,8 @@ private slots:
     void newFile();
     void open();
     void save();
+    void playBin();
+    void verifyBin();
 };
 
 #endif // PROFILED_DESIGNER_H